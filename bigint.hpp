@@ -1,9 +1,13 @@
 #ifndef CSE701_FINALPROJ_BIGINT_HPP
 #define CSE701_FINALPROJ_BIGINT_HPP
 #include <string>
+#include <string_view>
 #include <vector>
 #include <iostream>
 #include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <memory>
 using namespace std;
 /**
  * @class BigInt
@@ -15,9 +19,11 @@ using namespace std;
 class BigInt
 {
 private:
-    string number;    ///< The string representation of the integer's magnitude in reverse order.
-    bool is_negative; ///< Flag indicating whether the integer is negative.
+    string number;                          ///< The string representation of the integer's magnitude in reverse order.
+    shared_ptr<const string> shared_number; ///< Shared immutable magnitude, set only in shared storage mode.
+    bool is_negative;                       ///< Flag indicating whether the integer is negative.
 
+    const string &digits() const;                                          ///< Magnitude in reverse order, from whichever storage is active.
     BigInt add(const BigInt &other) const;                                 ///< Private helper function for addition.
     BigInt subtract(const BigInt &other) const;                            ///< Private helper function for subtraction.
     BigInt multiply(const BigInt &other) const;                            ///< Private helper function for multiplication.
@@ -26,9 +32,15 @@ private:
     static bool isSmaller(const string &num1, const string &num2);         ///< Compare two reversed string numbers.
 
 public:
-    BigInt();                           ///< Default constructor initializing to zero.
-    explicit BigInt(const string &num); ///< Constructor from string.
-    explicit BigInt(int64_t num);       ///< Constructor from int64_t.
+    BigInt();                                  ///< Default constructor initializing to zero.
+    explicit BigInt(const string &num);        ///< Constructor from string.
+    explicit BigInt(int64_t num);              ///< Constructor from int64_t.
+    BigInt(const BigInt &other) = default;     ///< Copy constructor; O(1) in shared storage mode.
+    BigInt(BigInt &&other) noexcept = default; ///< Move constructor.
+
+    // Shared storage mode
+    BigInt &share();       ///< Moves the magnitude into shared, reference-counted storage.
+    bool isShared() const; ///< Checks whether the magnitude is in shared storage.
 
     // Arithmetic operators
     BigInt operator+(const BigInt &other) const;
@@ -41,6 +53,9 @@ public:
     // Unary minus operator
     BigInt operator-() const;
 
+    // Absolute value
+    BigInt abs() const;
+
     // Comparison operators
     bool operator==(const BigInt &other) const;
     bool operator!=(const BigInt &other) const;
@@ -49,11 +64,44 @@ public:
     bool operator<=(const BigInt &other) const;
     bool operator>=(const BigInt &other) const;
 
-    // Assignment operator
-    BigInt &operator=(const BigInt &other);
+    // Assignment operators; copying a shared BigInt only copies the storage pointer
+    BigInt &operator=(const BigInt &other) = default;
+    BigInt &operator=(BigInt &&other) noexcept = default;
 
     // Stream insertion operator to support direct output to streams
     friend ostream &operator<<(ostream &out, const BigInt &bigInt);
+
+    // Stream extraction operator to support direct input from streams
+    friend istream &operator>>(istream &in, BigInt &bigInt);
+
+    friend class BigIntParser;
+    friend class BigIntRNS;
+};
+
+/**
+ * @class BigIntParser
+ * @brief An incremental parser that builds a BigInt from a sequence of text chunks.
+ *
+ * The parser accepts the same syntax as the BigInt string constructor, but the text
+ * may be supplied piece by piece from a buffer sequence or an input stream. Only the
+ * significant digits are retained, so memory stays proportional to the result rather
+ * than to the input text.
+ */
+class BigIntParser
+{
+private:
+    string digits;    ///< Significant digits consumed so far, most significant first.
+    size_t offset;    ///< Number of characters consumed so far.
+    bool is_negative; ///< Flag indicating whether a leading '-' was consumed.
+
+public:
+    BigIntParser(); ///< Constructs a parser with no input consumed.
+
+    void feed(const char *data, size_t length); ///< Consumes a chunk given as a pointer and length.
+    void feed(string_view chunk);               ///< Consumes a chunk given as a string view.
+    void feed(istream &in);                     ///< Consumes all remaining characters of a stream.
+    size_t consumed() const;                    ///< Number of characters consumed so far.
+    BigInt finish();                            ///< Produces the parsed BigInt and resets the parser.
 };
 
 // Definitions of the BigInt member functions with Doxygen comments
@@ -78,7 +126,7 @@ BigInt::BigInt(int64_t num)
     }
     else
     {
-        num = abs(num);
+        num = std::abs(num);
         number = to_string(num);
     }
     // Reverse the string to facilitate operations
@@ -140,6 +188,51 @@ BigInt::BigInt(const string &num)
     }
 }
 
+/**
+ * @brief Returns the magnitude of this BigInt in reverse order.
+ *
+ * In shared storage mode the magnitude lives in shared_number, otherwise in number.
+ * All read-only operations go through this accessor so they work in either mode.
+ *
+ * @return A reference to the active magnitude string.
+ */
+const string &BigInt::digits() const
+{
+    return shared_number ? *shared_number : number;
+}
+
+/**
+ * @brief Switches this BigInt to shared storage mode.
+ *
+ * The magnitude is moved into an immutable string owned through a shared_ptr. Copies,
+ * assignments, negation and abs() of a shared BigInt then only copy the pointer, which
+ * is O(1) regardless of the number of digits. The reference count is atomic, so shared
+ * copies may be handed to other threads. The storage is never written through: the
+ * compound assignment operators compute a new magnitude and replace the pointer, so
+ * other holders of the old storage are unaffected. The new magnitude is move-assigned
+ * into number and then moved into the shared string, so its digits are not copied.
+ *
+ * @return A reference to this BigInt.
+ */
+BigInt &BigInt::share()
+{
+    if (!shared_number)
+    {
+        shared_number = make_shared<const string>(move(number));
+        number.clear();
+    }
+    return *this;
+}
+
+/**
+ * @brief Checks whether this BigInt is in shared storage mode.
+ * @return True if the magnitude is held in shared storage, false otherwise.
+ */
+bool BigInt::isShared() const
+{
+    return shared_number != nullptr;
+}
+
 /**
  * @brief Adds two BigInt numbers.
  *
@@ -154,32 +247,32 @@ BigInt BigInt::add(const BigInt &other) const
 {
     if (!is_negative && !other.is_negative)
     {
-        return BigInt(addStrings(number, other.number));
+        return BigInt(addStrings(digits(), other.digits()));
     }
     else if (is_negative && other.is_negative)
     {
-        return BigInt("-" + addStrings(number, other.number));
+        return BigInt("-" + addStrings(digits(), other.digits()));
     }
     else if (is_negative)
     {
-        if (isSmaller(number, other.number))
+        if (isSmaller(digits(), other.digits()))
         {
-            return BigInt(subtractStrings(other.number, number));
+            return BigInt(subtractStrings(other.digits(), digits()));
         }
         else
         {
-            return BigInt("-" + subtractStrings(number, other.number));
+            return BigInt("-" + subtractStrings(digits(), other.digits()));
         }
     }
     else
     {
-        if (isSmaller(other.number, number))
+        if (isSmaller(other.digits(), digits()))
         {
-            return BigInt(subtractStrings(number, other.number));
+            return BigInt(subtractStrings(digits(), other.digits()));
         }
         else
         {
-            return BigInt("-" + subtractStrings(other.number, number));
+            return BigInt("-" + subtractStrings(other.digits(), digits()));
         }
     }
 }
@@ -201,13 +294,20 @@ BigInt BigInt::operator+(const BigInt &other) const
  * @brief Overloads the addition assignment operator for BigInt.
  *
  * Adds the other BigInt to the current object and assigns the result to the current object.
+ * If the current object is in shared storage mode, the result is shared as well; the old
+ * storage is released rather than modified.
  *
  * @param other The BigInt to add to the current object.
  * @return A reference to the current object after addition.
  */
 BigInt &BigInt::operator+=(const BigInt &other)
 {
+    bool was_shared = isShared();
     *this = *this + other;
+    if (was_shared)
+    {
+        share();
+    }
     return *this;
 }
 
@@ -330,33 +430,33 @@ BigInt BigInt::subtract(const BigInt &other) const
 {
     if (!is_negative && !other.is_negative)
     {
-        if (isSmaller(number, other.number))
+        if (isSmaller(digits(), other.digits()))
         {
-            return BigInt("-" + subtractStrings(other.number, number));
+            return BigInt("-" + subtractStrings(other.digits(), digits()));
         }
         else
         {
-            return BigInt(subtractStrings(number, other.number));
+            return BigInt(subtractStrings(digits(), other.digits()));
         }
     }
     else if (is_negative && other.is_negative)
     {
-        if (isSmaller(number, other.number))
+        if (isSmaller(digits(), other.digits()))
         {
-            return BigInt(subtractStrings(other.number, number));
+            return BigInt(subtractStrings(other.digits(), digits()));
         }
         else
         {
-            return BigInt("-" + subtractStrings(number, other.number));
+            return BigInt("-" + subtractStrings(digits(), other.digits()));
         }
     }
     else if (is_negative)
     {
-        return BigInt("-" + addStrings(number, other.number));
+        return BigInt("-" + addStrings(digits(), other.digits()));
     }
     else
     {
-        return BigInt(addStrings(number, other.number));
+        return BigInt(addStrings(digits(), other.digits()));
     }
 }
 
@@ -377,13 +477,20 @@ BigInt BigInt::operator-(const BigInt &other) const
  * @brief Overloads the subtraction assignment operator for BigInt.
  *
  * Subtracts the other BigInt from the current object and assigns the result to the current object.
+ * If the current object is in shared storage mode, the result is shared as well; the old
+ * storage is released rather than modified.
  *
  * @param other The BigInt to subtract from the current object.
  * @return A reference to the current object after subtraction.
  */
 BigInt &BigInt::operator-=(const BigInt &other)
 {
+    bool was_shared = isShared();
     *this = *this - other;
+    if (was_shared)
+    {
+        share();
+    }
     return *this;
 }
 
@@ -403,13 +510,190 @@ ostream &operator<<(ostream &out, const BigInt &bigInt)
     {
         out << '-';
     }
-    for (auto it = bigInt.number.rbegin(); it != bigInt.number.rend(); ++it)
+    const string &digits = bigInt.digits();
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it)
     {
         out << *it;
     }
     return out;
 }
 
+/**
+ * @brief Overloads the stream extraction operator for BigInt.
+ *
+ * Skips leading whitespace, then reads an optional '+' or '-' sign followed by as many
+ * digits as are available. Reading stops at the first non-digit character, which is left
+ * in the stream. The digits are passed to a BigIntParser in fixed-size chunks, so the
+ * text is never held in memory as a whole. If no digit is found, the failbit is set and
+ * bigInt is left unchanged.
+ *
+ * @param in The input stream.
+ * @param bigInt The BigInt object to read into.
+ * @return A reference to the input stream.
+ */
+istream &operator>>(istream &in, BigInt &bigInt)
+{
+    istream::sentry sentry(in);
+    if (!sentry)
+    {
+        return in;
+    }
+    using traits = istream::traits_type;
+    streambuf *buf = in.rdbuf();
+    BigIntParser parser;
+    char chunk[4096];
+    size_t length = 0;
+    bool has_digits = false;
+    traits::int_type c = buf->sgetc();
+    if (c == '+' || c == '-')
+    {
+        chunk[length++] = traits::to_char_type(c);
+        c = buf->snextc();
+    }
+    while (!traits::eq_int_type(c, traits::eof()) && isdigit(c))
+    {
+        has_digits = true;
+        chunk[length++] = traits::to_char_type(c);
+        if (length == sizeof(chunk))
+        {
+            parser.feed(chunk, length);
+            length = 0;
+        }
+        c = buf->snextc();
+    }
+    if (traits::eq_int_type(c, traits::eof()))
+    {
+        in.setstate(ios::eofbit);
+    }
+    if (!has_digits)
+    {
+        in.setstate(ios::failbit);
+        return in;
+    }
+    parser.feed(chunk, length);
+    bigInt = parser.finish();
+    return in;
+}
+
+/**
+ * @brief Default constructor for BigIntParser.
+ * Initializes the parser with no input consumed.
+ */
+BigIntParser::BigIntParser() : offset(0), is_negative(false) {}
+
+/**
+ * @brief Consumes a chunk of text.
+ *
+ * The first character of the whole input may be '+' or '-'; every other character must
+ * be a digit. Leading zeroes are discarded as they arrive.
+ *
+ * @param data Pointer to the first character of the chunk.
+ * @param length Number of characters in the chunk.
+ * @throws invalid_argument If the chunk contains an invalid character. The message and
+ *         consumed() both give the offset of that character within the whole input.
+ */
+void BigIntParser::feed(const char *data, size_t length)
+{
+    for (size_t i = 0; i < length; ++i, ++offset)
+    {
+        char c = data[i];
+        if (offset == 0 && (c == '-' || c == '+'))
+        {
+            is_negative = c == '-';
+            continue;
+        }
+        if (!isdigit(static_cast<unsigned char>(c)))
+        {
+            throw invalid_argument("Invalid character in number string at offset " + to_string(offset));
+        }
+        if (digits.empty() && c == '0')
+        {
+            continue;
+        }
+        digits += c;
+    }
+}
+
+/**
+ * @brief Consumes a chunk of text given as a string view.
+ * @param chunk The characters to consume.
+ * @throws invalid_argument If the chunk contains an invalid character.
+ */
+void BigIntParser::feed(string_view chunk)
+{
+    feed(chunk.data(), chunk.size());
+}
+
+/**
+ * @brief Consumes all remaining characters of an input stream.
+ *
+ * The stream is read in fixed-size blocks until end of file, so the text is never held
+ * in memory as a whole. Unlike operator>>, no whitespace is skipped. Reaching end of
+ * file leaves eofbit set on the stream, but the failbit raised by the final short read
+ * is cleared, so `if (!in)` after a successful call still reports success.
+ *
+ * @param in The input stream to read from.
+ * @throws invalid_argument If the stream contains an invalid character.
+ * @throws ios_base::failure If the stream reports an I/O error before end of file.
+ */
+void BigIntParser::feed(istream &in)
+{
+    ios::iostate initial = in.rdstate();
+    vector<char> buffer(1 << 16);
+    while (in.read(buffer.data(), static_cast<streamsize>(buffer.size())) || in.gcount() > 0)
+    {
+        feed(buffer.data(), static_cast<size_t>(in.gcount()));
+    }
+    if (in.bad())
+    {
+        throw ios_base::failure("I/O error while reading number at offset " + to_string(offset));
+    }
+    if (in.eof() && !(initial & ios::failbit))
+    {
+        in.clear(in.rdstate() & ~ios::failbit);
+    }
+}
+
+/**
+ * @brief Returns the number of characters consumed so far.
+ *
+ * After feed() throws, this is the offset of the offending character.
+ *
+ * @return The number of characters consumed.
+ */
+size_t BigIntParser::consumed() const
+{
+    return offset;
+}
+
+/**
+ * @brief Produces the BigInt described by the consumed text.
+ *
+ * The collected digits are reversed in place and moved into the result, so no second
+ * copy of the number is made. The parser is reset and can be reused afterwards.
+ *
+ * @return The parsed BigInt.
+ * @throws invalid_argument If no input was consumed.
+ */
+BigInt BigIntParser::finish()
+{
+    if (offset == 0)
+    {
+        throw invalid_argument("Input string is empty");
+    }
+    BigInt result;
+    if (!digits.empty())
+    {
+        reverse(digits.begin(), digits.end());
+        result.number = move(digits);
+        result.is_negative = is_negative;
+    }
+    digits.clear();
+    offset = 0;
+    is_negative = false;
+    return result;
+}
+
 /**
  * @brief Multiplies this BigInt with another BigInt.
  *
@@ -422,8 +706,10 @@ ostream &operator<<(ostream &out, const BigInt &bigInt)
  */
 BigInt BigInt::multiply(const BigInt &other) const
 {
-    int n1 = static_cast<int>(number.size());
-    int n2 = static_cast<int>(other.number.size());
+    const string &lhs = digits();
+    const string &rhs = other.digits();
+    int n1 = static_cast<int>(lhs.size());
+    int n2 = static_cast<int>(rhs.size());
     if (n1 == 0 || n2 == 0)
     {
         return BigInt("0");
@@ -432,10 +718,10 @@ BigInt BigInt::multiply(const BigInt &other) const
     for (int i = n1 - 1; i >= 0; i--)
     {
         int carry = 0;
-        int n1_digit = number[i] - '0';
+        int n1_digit = lhs[i] - '0';
         for (int j = n2 - 1; j >= 0; j--)
         {
-            int n2_digit = other.number[j] - '0';
+            int n2_digit = rhs[j] - '0';
             int sum = n1_digit * n2_digit + result[i + j + 1] + carry;
             carry = sum / 10;
             result[i + j + 1] = sum % 10;
@@ -478,33 +764,56 @@ BigInt BigInt::operator*(const BigInt &other) const
  * @brief Overloads the multiplication assignment operator for BigInt.
  *
  * Multiplies the other BigInt with the current object and assigns the result to the current object.
+ * If the current object is in shared storage mode, the result is shared as well; the old
+ * storage is released rather than modified.
  *
  * @param other The BigInt to multiply with this BigInt.
  * @return A reference to the current object after multiplication.
  */
 BigInt &BigInt::operator*=(const BigInt &other)
 {
+    bool was_shared = isShared();
     *this = *this * other;
+    if (was_shared)
+    {
+        share();
+    }
     return *this;
 }
 
 /**
  * @brief Overloads the unary minus operator for BigInt.
  *
- * Creates a copy of the current BigInt and changes its sign.
+ * Creates a copy of the current BigInt and changes its sign. The copy is O(1) when
+ * this BigInt is in shared storage mode.
  *
  * @return A BigInt with the opposite sign of this BigInt.
  */
 BigInt BigInt::operator-() const
 {
     BigInt result(*this);
-    if (result.number != "0")
+    if (result.digits() != "0")
     {
         result.is_negative = !is_negative;
     }
     return result;
 }
 
+/**
+ * @brief Returns the absolute value of this BigInt.
+ *
+ * Creates a copy of the current BigInt with a non-negative sign. The copy is O(1) when
+ * this BigInt is in shared storage mode.
+ *
+ * @return A BigInt with the magnitude of this BigInt.
+ */
+BigInt BigInt::abs() const
+{
+    BigInt result(*this);
+    result.is_negative = false;
+    return result;
+}
+
 /**
  * @brief Overloads the equality operator for BigInt.
  *
@@ -515,7 +824,15 @@ BigInt BigInt::operator-() const
  */
 bool BigInt::operator==(const BigInt &other) const
 {
-    return number == other.number && is_negative == other.is_negative;
+    if (is_negative != other.is_negative)
+    {
+        return false;
+    }
+    if (shared_number && shared_number == other.shared_number)
+    {
+        return true;
+    }
+    return digits() == other.digits();
 }
 
 /**
@@ -543,15 +860,17 @@ bool BigInt::operator<(const BigInt &other) const
 {
     if (is_negative != other.is_negative)
         return is_negative;
-    if (number.size() != other.number.size())
+    const string &lhs = digits();
+    const string &rhs = other.digits();
+    if (lhs.size() != rhs.size())
     {
-        return is_negative ? (number.size() > other.number.size()) : (number.size() < other.number.size());
+        return is_negative ? (lhs.size() > rhs.size()) : (lhs.size() < rhs.size());
     }
-    for (int i = static_cast<int>(number.size()) - 1; i >= 0; --i)
+    for (int i = static_cast<int>(lhs.size()) - 1; i >= 0; --i)
     {
-        if (number[i] != other.number[i])
+        if (lhs[i] != rhs[i])
         {
-            return is_negative ? (number[i] > other.number[i]) : (number[i] < other.number[i]);
+            return is_negative ? (lhs[i] > rhs[i]) : (lhs[i] < rhs[i]);
         }
     }
     return false;
@@ -595,22 +914,4 @@ bool BigInt::operator>=(const BigInt &other) const
 {
     return !(*this < other);
 }
-
-/**
- * @brief Overloads the assignment operator for BigInt.
- *
- * Assigns the value of another BigInt to this BigInt.
- *
- * @param other The BigInt to assign to this BigInt.
- * @return A reference to this BigInt after assignment.
- */
-BigInt &BigInt::operator=(const BigInt &other)
-{
-    if (this != &other)
-    {
-        number = other.number;
-        is_negative = other.is_negative;
-    }
-    return *this;
-}
 #endif // CSE701_FINALPROJ_BIGINT_HPP
\ No newline at end of file
@@ -0,0 +1,740 @@
+#ifndef CSE701_FINALPROJ_BIGINT_RNS_HPP
+#define CSE701_FINALPROJ_BIGINT_RNS_HPP
+#include "bigint.hpp"
+#include <cstdint>
+#include <cmath>
+#include <memory>
+using namespace std;
+/**
+ * @class BigIntRNS
+ * @brief A class to represent integers in a residue number system for carry-free arithmetic.
+ *
+ * A BigIntRNS stores an integer as its residues modulo a set of word-size primes, called
+ * the basis. Addition, subtraction and multiplication work on each residue independently,
+ * with no carries between them, so their cost is linear in the number of primes. The value
+ * is recovered with the Chinese Remainder Theorem. The product M of the primes must exceed
+ * twice the absolute value of the final result; intermediate results may be larger.
+ */
+class BigIntRNS
+{
+private:
+    using Limbs = vector<uint32_t>; ///< Magnitude in base 10^9, least significant limb first.
+
+    static constexpr uint32_t limb_base = 1000000000; ///< Base of the Limbs representation.
+
+    static Limbs fromWord(uint64_t value);                                  ///< Converts a word to Limbs.
+    static Limbs addLimbs(const Limbs &num1, const Limbs &num2);            ///< Adds two Limbs numbers.
+    static Limbs subtractLimbs(const Limbs &num1, const Limbs &num2);       ///< Subtracts num2 from num1, requires num1 >= num2.
+    static Limbs multiplyLimbs(const Limbs &num1, const Limbs &num2);       ///< Multiplies two Limbs numbers.
+    static bool isSmallerLimbs(const Limbs &num1, const Limbs &num2);       ///< Compares two Limbs numbers.
+    static uint32_t powMod(uint32_t base, uint32_t exponent, uint32_t mod); ///< Modular exponentiation.
+    static bool isPrime(uint32_t n);                                        ///< Deterministic primality test for 32-bit words.
+
+public:
+    /**
+     * @class Basis
+     * @brief An immutable set of primes together with the data needed for reconstruction.
+     *
+     * A Basis is shared between all BigIntRNS values that are combined with each other.
+     * It holds the primes, the CRT coefficients and the subproduct tree of the primes.
+     */
+    class Basis
+    {
+    private:
+        vector<uint32_t> primes;              ///< The moduli, all odd and below 2^31.
+        vector<uint32_t> inverses;            ///< (M / p_i)^-1 mod p_i for every prime p_i.
+        vector<uint32_t> montgomery_inverses; ///< -p_i^-1 mod 2^32, used by Montgomery reduction.
+        vector<uint32_t> montgomery_squares;  ///< 2^64 mod p_i, converts a Montgomery product back.
+        vector<Limbs> tree;                   ///< Subproduct tree in heap order; tree[1] is M.
+        size_t max_digits;                    ///< Largest number of decimal digits of a representable value.
+
+        Basis() = default;
+        void buildTree(size_t node, size_t lo, size_t hi);
+
+        friend class BigIntRNS;
+
+    public:
+        static shared_ptr<const Basis> forDigits(size_t digits);      ///< Basis for values of up to digits decimal digits.
+        static shared_ptr<const Basis> forBound(const BigInt &bound); ///< Basis for values with |value| <= |bound|.
+
+        size_t size() const;                    ///< Number of primes in the basis.
+        size_t capacity() const;                ///< Largest number of decimal digits of a representable value.
+        const vector<uint32_t> &moduli() const; ///< The primes of the basis.
+    };
+
+private:
+    shared_ptr<const Basis> basis; ///< The basis shared with compatible values.
+    vector<uint32_t> residues;     ///< The residue modulo each prime of the basis.
+
+    void checkBasis(const BigIntRNS &other) const; ///< Ensures both operands use the same basis.
+    Limbs combine(const vector<uint32_t> &coefficients, size_t node, size_t lo, size_t hi) const; ///< CRT sum over a subtree.
+
+public:
+    explicit BigIntRNS(shared_ptr<const Basis> basis);             ///< Constructor initializing to zero.
+    BigIntRNS(const BigInt &value, shared_ptr<const Basis> basis); ///< Constructor from BigInt.
+
+    BigInt toBigInt() const; ///< Reconstructs the value as a BigInt.
+
+    const shared_ptr<const Basis> &getBasis() const; ///< The basis of this value.
+    const vector<uint32_t> &getResidues() const;     ///< The residues of this value.
+
+    // Arithmetic operators
+    BigIntRNS operator+(const BigIntRNS &other) const;
+    BigIntRNS operator-(const BigIntRNS &other) const;
+    BigIntRNS operator*(const BigIntRNS &other) const;
+    BigIntRNS &operator+=(const BigIntRNS &other);
+    BigIntRNS &operator-=(const BigIntRNS &other);
+    BigIntRNS &operator*=(const BigIntRNS &other);
+
+    // Unary minus operator
+    BigIntRNS operator-() const;
+
+    // Comparison operators
+    bool operator==(const BigIntRNS &other) const;
+    bool operator!=(const BigIntRNS &other) const;
+};
+
+// Definitions of the BigIntRNS member functions with Doxygen comments
+
+/**
+ * @brief Converts a machine word to Limbs.
+ * @param value The word to convert.
+ * @return The Limbs representation of value, empty for zero.
+ */
+BigIntRNS::Limbs BigIntRNS::fromWord(uint64_t value)
+{
+    Limbs result;
+    while (value > 0)
+    {
+        result.push_back(static_cast<uint32_t>(value % limb_base));
+        value /= limb_base;
+    }
+    return result;
+}
+
+/**
+ * @brief Adds two numbers represented as Limbs.
+ * @param num1 The first number.
+ * @param num2 The second number.
+ * @return The sum of the two numbers.
+ */
+BigIntRNS::Limbs BigIntRNS::addLimbs(const Limbs &num1, const Limbs &num2)
+{
+    Limbs result;
+    result.reserve(max(num1.size(), num2.size()) + 1);
+    uint32_t carry = 0;
+    for (size_t i = 0; i < num1.size() || i < num2.size() || carry; ++i)
+    {
+        uint32_t sum = carry;
+        if (i < num1.size())
+            sum += num1[i];
+        if (i < num2.size())
+            sum += num2[i];
+        carry = sum >= limb_base;
+        result.push_back(carry ? sum - limb_base : sum);
+    }
+    return result;
+}
+
+/**
+ * @brief Subtracts two numbers represented as Limbs.
+ * @param num1 The larger or equal number.
+ * @param num2 The smaller or equal number.
+ * @return The difference of the two numbers, without leading zero limbs.
+ */
+BigIntRNS::Limbs BigIntRNS::subtractLimbs(const Limbs &num1, const Limbs &num2)
+{
+    Limbs result(num1);
+    uint32_t borrow = 0;
+    for (size_t i = 0; i < result.size() && (i < num2.size() || borrow); ++i)
+    {
+        uint32_t subtrahend = borrow + (i < num2.size() ? num2[i] : 0);
+        borrow = result[i] < subtrahend;
+        result[i] = borrow ? result[i] + limb_base - subtrahend : result[i] - subtrahend;
+    }
+    while (!result.empty() && result.back() == 0)
+    {
+        result.pop_back();
+    }
+    return result;
+}
+
+/**
+ * @brief Multiplies two numbers represented as Limbs using the grade school algorithm.
+ * @param num1 The first number.
+ * @param num2 The second number.
+ * @return The product of the two numbers, without leading zero limbs.
+ */
+BigIntRNS::Limbs BigIntRNS::multiplyLimbs(const Limbs &num1, const Limbs &num2)
+{
+    if (num1.empty() || num2.empty())
+    {
+        return Limbs();
+    }
+    Limbs result(num1.size() + num2.size(), 0);
+    for (size_t i = 0; i < num1.size(); ++i)
+    {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < num2.size(); ++j)
+        {
+            uint64_t cur = static_cast<uint64_t>(num1[i]) * num2[j] + result[i + j] + carry;
+            result[i + j] = static_cast<uint32_t>(cur % limb_base);
+            carry = cur / limb_base;
+        }
+        result[i + num2.size()] = static_cast<uint32_t>(carry);
+    }
+    while (!result.empty() && result.back() == 0)
+    {
+        result.pop_back();
+    }
+    return result;
+}
+
+/**
+ * @brief Determines if one number represented as Limbs is smaller than another.
+ * @param num1 The first number, without leading zero limbs.
+ * @param num2 The second number, without leading zero limbs.
+ * @return True if num1 is smaller than num2.
+ */
+bool BigIntRNS::isSmallerLimbs(const Limbs &num1, const Limbs &num2)
+{
+    if (num1.size() != num2.size())
+    {
+        return num1.size() < num2.size();
+    }
+    for (size_t i = num1.size(); i-- > 0;)
+    {
+        if (num1[i] != num2[i])
+        {
+            return num1[i] < num2[i];
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Computes base^exponent mod mod by repeated squaring.
+ * @param base The base, smaller than mod.
+ * @param exponent The exponent.
+ * @param mod The modulus, below 2^32.
+ * @return The result of the exponentiation.
+ */
+uint32_t BigIntRNS::powMod(uint32_t base, uint32_t exponent, uint32_t mod)
+{
+    uint64_t result = 1 % mod;
+    uint64_t power = base % mod;
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = result * power % mod;
+        }
+        power = power * power % mod;
+        exponent >>= 1;
+    }
+    return static_cast<uint32_t>(result);
+}
+
+/**
+ * @brief Tests a 32-bit word for primality.
+ *
+ * Uses the Miller-Rabin test with the bases 2, 7 and 61, which is deterministic for
+ * all numbers below 4759123141.
+ *
+ * @param n The number to test.
+ * @return True if n is prime.
+ */
+bool BigIntRNS::isPrime(uint32_t n)
+{
+    if (n < 2)
+        return false;
+    for (uint32_t small : {2u, 3u, 5u, 7u, 61u})
+    {
+        if (n % small == 0)
+            return n == small;
+    }
+    uint32_t d = n - 1;
+    int s = 0;
+    while ((d & 1) == 0)
+    {
+        d >>= 1;
+        ++s;
+    }
+    for (uint32_t a : {2u, 7u, 61u})
+    {
+        uint64_t x = powMod(a, d, n);
+        if (x == 1 || x == n - 1)
+            continue;
+        bool composite = true;
+        for (int r = 1; r < s && composite; ++r)
+        {
+            x = x * x % n;
+            composite = x != n - 1;
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Builds the subproduct tree of the primes in [lo, hi) rooted at node.
+ *
+ * Each leaf holds one prime and each inner node holds the product of its children, so
+ * the root holds the product M of all primes.
+ *
+ * @param node The heap index of the subtree root.
+ * @param lo The index of the first prime covered by the subtree.
+ * @param hi One past the index of the last prime covered by the subtree.
+ */
+void BigIntRNS::Basis::buildTree(size_t node, size_t lo, size_t hi)
+{
+    if (hi - lo == 1)
+    {
+        tree[node] = fromWord(primes[lo]);
+        return;
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    buildTree(2 * node, lo, mid);
+    buildTree(2 * node + 1, mid, hi);
+    tree[node] = multiplyLimbs(tree[2 * node], tree[2 * node + 1]);
+}
+
+/**
+ * @brief Creates a basis large enough for values of up to the given number of decimal digits.
+ *
+ * Primes are taken downward from 2^31 - 1 until the product M of the primes exceeds
+ * 2 * 10^digits, so every value with |value| < 10^digits has a unique representation.
+ * For k primes, building the subproduct tree and the CRT coefficients each costs
+ * O(k^2) word operations, so a basis should be created once and shared.
+ *
+ * @param digits The largest number of decimal digits of a value to be represented.
+ * @return A shared pointer to the new basis.
+ * @throws overflow_error If the odd primes below 2^31 cannot cover digits decimal digits.
+ */
+shared_ptr<const BigIntRNS::Basis> BigIntRNS::Basis::forDigits(size_t digits)
+{
+    shared_ptr<Basis> basis(new Basis());
+    // Leave a small margin so rounding in the logarithms cannot overstate the capacity
+    double needed = static_cast<double>(digits) + log10(2.0) + 1e-9;
+    double available = 0.0;
+    uint32_t candidate = 2147483647u;
+    while (available < needed)
+    {
+        if (candidate < 3)
+        {
+            throw overflow_error("Requested bound exceeds the largest possible RNS basis");
+        }
+        if (isPrime(candidate))
+        {
+            basis->primes.push_back(candidate);
+            available += log10(static_cast<double>(candidate));
+        }
+        candidate -= 2;
+    }
+    size_t k = basis->primes.size();
+    basis->max_digits = static_cast<size_t>(floor(available - log10(2.0) - 1e-9));
+    basis->tree.resize(4 * k);
+    basis->buildTree(1, 0, k);
+    basis->inverses.resize(k);
+    basis->montgomery_inverses.resize(k);
+    basis->montgomery_squares.resize(k);
+    for (size_t i = 0; i < k; ++i)
+    {
+        uint32_t p = basis->primes[i];
+        // Newton iteration doubles the number of correct low bits of p^-1 mod 2^32 each step
+        uint32_t inverse = p;
+        for (int step = 0; step < 4; ++step)
+        {
+            inverse *= 2 - p * inverse;
+        }
+        basis->montgomery_inverses[i] = 0u - inverse;
+        uint64_t r = (static_cast<uint64_t>(1) << 32) % p;
+        basis->montgomery_squares[i] = static_cast<uint32_t>(r * r % p);
+        uint64_t cofactor = 1;
+        for (size_t j = 0; j < k; ++j)
+        {
+            if (j != i)
+            {
+                cofactor = cofactor * (basis->primes[j] % p) % p;
+            }
+        }
+        basis->inverses[i] = powMod(static_cast<uint32_t>(cofactor), p - 2, p);
+    }
+    return basis;
+}
+
+/**
+ * @brief Creates a basis large enough for every value whose absolute value is at most |bound|.
+ * @param bound The declared bound on the results to be represented.
+ * @return A shared pointer to the new basis.
+ */
+shared_ptr<const BigIntRNS::Basis> BigIntRNS::Basis::forBound(const BigInt &bound)
+{
+    return forDigits(bound.digits().size());
+}
+
+/**
+ * @brief Returns the number of primes in the basis.
+ * @return The number of primes.
+ */
+size_t BigIntRNS::Basis::size() const
+{
+    return primes.size();
+}
+
+/**
+ * @brief Returns the largest number of decimal digits of a representable value.
+ * @return The capacity of the basis in decimal digits.
+ */
+size_t BigIntRNS::Basis::capacity() const
+{
+    return max_digits;
+}
+
+/**
+ * @brief Returns the primes of the basis.
+ * @return A reference to the vector of primes.
+ */
+const vector<uint32_t> &BigIntRNS::Basis::moduli() const
+{
+    return primes;
+}
+
+/**
+ * @brief Constructs a BigIntRNS with value zero.
+ * @param basis The basis to represent the value in.
+ * @throws invalid_argument If basis is null.
+ */
+BigIntRNS::BigIntRNS(shared_ptr<const Basis> basis) : basis(move(basis))
+{
+    if (!this->basis)
+    {
+        throw invalid_argument("RNS basis is null");
+    }
+    residues.assign(this->basis->size(), 0);
+}
+
+/**
+ * @brief Constructs a BigIntRNS from a BigInt.
+ *
+ * The decimal digits are grouped into blocks of nine and folded into every residue with
+ * Horner's rule, so each prime costs one multiply and one reduction per block.
+ *
+ * @param value The value to convert.
+ * @param basis The basis to represent the value in.
+ * @throws invalid_argument If basis is null.
+ * @throws overflow_error If value has more digits than the basis can represent.
+ */
+BigIntRNS::BigIntRNS(const BigInt &value, shared_ptr<const Basis> basis) : BigIntRNS(move(basis))
+{
+    const string &digits = value.digits();
+    if (digits.size() > this->basis->capacity())
+    {
+        throw overflow_error("Value exceeds the capacity of the RNS basis");
+    }
+    const vector<uint32_t> &primes = this->basis->moduli();
+    size_t k = primes.size();
+    size_t i = digits.size();
+    while (i > 0)
+    {
+        size_t block = (i - 1) % 9 + 1;
+        uint32_t chunk = 0;
+        uint32_t scale = 1;
+        for (size_t j = 0; j < block; ++j)
+        {
+            chunk = chunk * 10 + static_cast<uint32_t>(digits[i - 1 - j] - '0');
+            scale *= 10;
+        }
+        i -= block;
+        for (size_t r = 0; r < k; ++r)
+        {
+            residues[r] = static_cast<uint32_t>((static_cast<uint64_t>(residues[r]) * scale + chunk) % primes[r]);
+        }
+    }
+    if (value.is_negative)
+    {
+        *this = -*this;
+    }
+}
+
+/**
+ * @brief Computes the CRT sum for the primes in [lo, hi) using the subproduct tree.
+ *
+ * For a subtree covering the primes p_lo..p_hi-1 with product P, returns the sum of
+ * c_i * P / p_i. The two halves are combined as left * P_right + right * P_left.
+ *
+ * @param coefficients The values c_i = r_i * (M / p_i)^-1 mod p_i.
+ * @param node The heap index of the subtree root.
+ * @param lo The index of the first prime covered by the subtree.
+ * @param hi One past the index of the last prime covered by the subtree.
+ * @return The CRT sum for the subtree.
+ */
+BigIntRNS::Limbs BigIntRNS::combine(const vector<uint32_t> &coefficients, size_t node, size_t lo, size_t hi) const
+{
+    if (hi - lo == 1)
+    {
+        return fromWord(coefficients[lo]);
+    }
+    size_t mid = lo + (hi - lo) / 2;
+    Limbs left = combine(coefficients, 2 * node, lo, mid);
+    Limbs right = combine(coefficients, 2 * node + 1, mid, hi);
+    return addLimbs(multiplyLimbs(left, basis->tree[2 * node + 1]), multiplyLimbs(right, basis->tree[2 * node]));
+}
+
+/**
+ * @brief Reconstructs the value as a BigInt using the Chinese Remainder Theorem.
+ *
+ * The sum S of c_i * M / p_i is built over the subproduct tree. Since S / M is the sum
+ * of c_i / p_i, the quotient of S by M is estimated in floating point and corrected by
+ * at most one step. Results above M / 2 are mapped to negative values.
+ *
+ * @return A BigInt with the represented value.
+ */
+BigInt BigIntRNS::toBigInt() const
+{
+    const vector<uint32_t> &primes = basis->moduli();
+    size_t k = primes.size();
+    vector<uint32_t> coefficients(k);
+    double quotient = 0.0;
+    for (size_t i = 0; i < k; ++i)
+    {
+        coefficients[i] = static_cast<uint32_t>(static_cast<uint64_t>(residues[i]) * basis->inverses[i] % primes[i]);
+        quotient += static_cast<double>(coefficients[i]) / primes[i];
+    }
+    const Limbs &modulus = basis->tree[1];
+    Limbs sum = combine(coefficients, 1, 0, k);
+    Limbs reduction = multiplyLimbs(modulus, fromWord(static_cast<uint64_t>(quotient)));
+    while (isSmallerLimbs(sum, reduction))
+    {
+        reduction = subtractLimbs(reduction, modulus);
+    }
+    Limbs magnitude = subtractLimbs(sum, reduction);
+    while (!isSmallerLimbs(magnitude, modulus))
+    {
+        magnitude = subtractLimbs(magnitude, modulus);
+    }
+    bool negative = isSmallerLimbs(subtractLimbs(modulus, magnitude), magnitude);
+    if (negative)
+    {
+        magnitude = subtractLimbs(modulus, magnitude);
+    }
+    BigInt result;
+    if (!magnitude.empty())
+    {
+        string number;
+        number.reserve(magnitude.size() * 9);
+        for (uint32_t limb : magnitude)
+        {
+            for (int j = 0; j < 9; ++j)
+            {
+                number += static_cast<char>('0' + limb % 10);
+                limb /= 10;
+            }
+        }
+        while (number.size() > 1 && number.back() == '0')
+        {
+            number.pop_back();
+        }
+        result.number = move(number);
+        result.is_negative = negative;
+    }
+    return result;
+}
+
+/**
+ * @brief Returns the basis of this value.
+ * @return A reference to the shared basis.
+ */
+const shared_ptr<const BigIntRNS::Basis> &BigIntRNS::getBasis() const
+{
+    return basis;
+}
+
+/**
+ * @brief Returns the residues of this value, one per prime of the basis.
+ * @return A reference to the vector of residues.
+ */
+const vector<uint32_t> &BigIntRNS::getResidues() const
+{
+    return residues;
+}
+
+/**
+ * @brief Ensures another BigIntRNS uses the same basis as this one.
+ * @param other The other operand.
+ * @throws invalid_argument If the bases differ.
+ */
+void BigIntRNS::checkBasis(const BigIntRNS &other) const
+{
+    if (basis != other.basis)
+    {
+        throw invalid_argument("RNS operands use different bases");
+    }
+}
+
+/**
+ * @brief Overloads the addition operator for BigIntRNS.
+ * @param other The BigIntRNS to add to the current object.
+ * @return A new BigIntRNS representing the sum.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS BigIntRNS::operator+(const BigIntRNS &other) const
+{
+    BigIntRNS result(*this);
+    result += other;
+    return result;
+}
+
+/**
+ * @brief Overloads the subtraction operator for BigIntRNS.
+ * @param other The BigIntRNS to subtract from the current object.
+ * @return A new BigIntRNS representing the difference.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS BigIntRNS::operator-(const BigIntRNS &other) const
+{
+    BigIntRNS result(*this);
+    result -= other;
+    return result;
+}
+
+/**
+ * @brief Overloads the multiplication operator for BigIntRNS.
+ * @param other The BigIntRNS to multiply with the current object.
+ * @return A new BigIntRNS representing the product.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS BigIntRNS::operator*(const BigIntRNS &other) const
+{
+    BigIntRNS result(*this);
+    result *= other;
+    return result;
+}
+
+/**
+ * @brief Overloads the addition assignment operator for BigIntRNS.
+ *
+ * Adds residue by residue. All primes are below 2^31, so the sum fits in 32 bits and
+ * is reduced with a single conditional subtraction; the loop has no carries and no
+ * branches that depend on neighbouring residues, so the compiler can vectorize it.
+ *
+ * @param other The BigIntRNS to add to the current object.
+ * @return A reference to the current object after addition.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS &BigIntRNS::operator+=(const BigIntRNS &other)
+{
+    checkBasis(other);
+    const uint32_t *primes = basis->moduli().data();
+    const uint32_t *rhs = other.residues.data();
+    uint32_t *lhs = residues.data();
+    size_t k = residues.size();
+    for (size_t i = 0; i < k; ++i)
+    {
+        uint32_t sum = lhs[i] + rhs[i];
+        lhs[i] = sum >= primes[i] ? sum - primes[i] : sum;
+    }
+    return *this;
+}
+
+/**
+ * @brief Overloads the subtraction assignment operator for BigIntRNS.
+ *
+ * Subtracts residue by residue, adding the prime back where the difference would be
+ * negative. The correction is applied through a mask rather than a branch, so the
+ * compiler can vectorize the loop.
+ *
+ * @param other The BigIntRNS to subtract from the current object.
+ * @return A reference to the current object after subtraction.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS &BigIntRNS::operator-=(const BigIntRNS &other)
+{
+    checkBasis(other);
+    const uint32_t *primes = basis->moduli().data();
+    const uint32_t *rhs = other.residues.data();
+    uint32_t *lhs = residues.data();
+    size_t k = residues.size();
+    for (size_t i = 0; i < k; ++i)
+    {
+        uint32_t mask = 0u - static_cast<uint32_t>(lhs[i] < rhs[i]);
+        lhs[i] = lhs[i] - rhs[i] + (primes[i] & mask);
+    }
+    return *this;
+}
+
+/**
+ * @brief Overloads the multiplication assignment operator for BigIntRNS.
+ *
+ * Multiplies residue by residue without any division. Each 64-bit product is reduced
+ * with Montgomery reduction, which gives a * b * 2^-32 mod p; a second reduction of that
+ * result times 2^64 mod p removes the 2^-32 factor. Both steps use only 32 x 32 -> 64 bit
+ * multiplies, shifts and a masked subtraction, so the compiler can vectorize the loop.
+ *
+ * @param other The BigIntRNS to multiply with the current object.
+ * @return A reference to the current object after multiplication.
+ * @throws invalid_argument If the operands use different bases.
+ */
+BigIntRNS &BigIntRNS::operator*=(const BigIntRNS &other)
+{
+    checkBasis(other);
+    const uint32_t *primes = basis->moduli().data();
+    const uint32_t *rhs = other.residues.data();
+    uint32_t *lhs = residues.data();
+    size_t k = residues.size();
+    const uint32_t *inverses = basis->montgomery_inverses.data();
+    const uint32_t *squares = basis->montgomery_squares.data();
+    for (size_t i = 0; i < k; ++i)
+    {
+        // Operands are below p < 2^31, so every intermediate sum stays below 2^64
+        uint64_t product = static_cast<uint64_t>(lhs[i]) * rhs[i];
+        uint32_t m = static_cast<uint32_t>(product) * inverses[i];
+        uint32_t t = static_cast<uint32_t>((product + static_cast<uint64_t>(m) * primes[i]) >> 32);
+        t -= primes[i] & (0u - static_cast<uint32_t>(t >= primes[i]));
+        product = static_cast<uint64_t>(t) * squares[i];
+        m = static_cast<uint32_t>(product) * inverses[i];
+        t = static_cast<uint32_t>((product + static_cast<uint64_t>(m) * primes[i]) >> 32);
+        lhs[i] = t - (primes[i] & (0u - static_cast<uint32_t>(t >= primes[i])));
+    }
+    return *this;
+}
+
+/**
+ * @brief Overloads the unary minus operator for BigIntRNS.
+ * @return A BigIntRNS with the opposite sign of this BigIntRNS.
+ */
+BigIntRNS BigIntRNS::operator-() const
+{
+    BigIntRNS result(basis);
+    result -= *this;
+    return result;
+}
+
+/**
+ * @brief Overloads the equality operator for BigIntRNS.
+ *
+ * Residues are unique within the range of the basis, so the values are equal exactly
+ * when all residues match.
+ *
+ * @param other The BigIntRNS to compare with this BigIntRNS.
+ * @return True if this BigIntRNS is equal to other, false otherwise.
+ * @throws invalid_argument If the operands use different bases.
+ */
+bool BigIntRNS::operator==(const BigIntRNS &other) const
+{
+    checkBasis(other);
+    return residues == other.residues;
+}
+
+/**
+ * @brief Overloads the inequality operator for BigIntRNS.
+ * @param other The BigIntRNS to compare with this BigIntRNS.
+ * @return True if this BigIntRNS is not equal to other, false otherwise.
+ * @throws invalid_argument If the operands use different bases.
+ */
+bool BigIntRNS::operator!=(const BigIntRNS &other) const
+{
+    return !(*this == other);
+}
+#endif // CSE701_FINALPROJ_BIGINT_RNS_HPP
@@ -1,6 +1,9 @@
 #include "bigint.hpp"
+#include "bigint_rns.hpp"
 #include <iostream>
 #include <exception>
+#include <limits>
+#include <sstream>
 
 using namespace std;
 
@@ -73,6 +76,35 @@ int main()
         BigInt assignmentOperator;
         assignmentOperator = fromStr;
         cout << "Assignment (=): " << assignmentOperator << endl;
+
+        // Demonstrates the stream extraction operator (>>) with BigInts.
+        istringstream input("  -98765432109876543210 42");
+        BigInt extracted;
+        input >> extracted;
+        cout << "Stream extraction (>>): " << extracted << endl;
+
+        // Demonstrates incremental parsing of a number supplied in several chunks.
+        BigIntParser parser;
+        parser.feed("123456789");
+        parser.feed("012345678");
+        parser.feed("9");
+        cout << "Incremental parsing: " << parser.finish() << endl;
+
+        // Demonstrates shared storage mode, where copies only share the digits.
+        BigInt shared(fromStr);
+        shared.share();
+        BigInt sharedCopy = shared;
+        cout << "Shared storage: " << sharedCopy << " (shared: " << (sharedCopy.isShared() ? "true" : "false") << ")" << endl;
+
+        // Demonstrates the absolute value of a BigInt.
+        cout << "Absolute value: |" << fromStr << "| = " << fromStr.abs() << endl;
+
+        // Demonstrates carry-free arithmetic in a residue number system.
+        auto basis = BigIntRNS::Basis::forDigits(45);
+        BigIntRNS rnsStr(fromStr, basis);
+        BigIntRNS rnsInt64(fromInt64, basis);
+        BigIntRNS rnsResult = rnsStr * rnsInt64 + rnsStr;
+        cout << "Residue number system (" << basis->size() << " primes): " << fromStr << " * " << fromInt64 << " + " << fromStr << " = " << rnsResult.toBigInt() << endl;
     }
     catch (const invalid_argument &e)
     {